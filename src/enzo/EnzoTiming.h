@@ -13,6 +13,14 @@
 /           code section
 /       enzo_timer: Contains general information and section_performance 
 /           objects.
+/  modified2:
+/   The timers also form a tree of nested regions: a timer started while
+/   another one runs is recorded under it, e.g.
+/   Total/Level_01/SetBoundaryConditions.  The region tree is reduced
+/   over all processes and appended as one JSON line per write-out to
+/   performance.json, along with the spread of the time spent on single
+/   grids of each level.  Timers started inside threaded grid loops are
+/   kept per thread and summed at write-out.
 /
 ************************************************************************/
 
@@ -22,12 +30,17 @@
 #ifdef USE_MPI
 #include "mpi.h"
 #endif /* USE_MPI */
+#ifdef USE_OPENMP
+#include <omp.h>
+#endif /* USE_OPENMP */
 
 #include <stdio.h>
 #include <math.h>
 #include <string>
 #include <cstring>
 #include <map>
+#include <set>
+#include <vector>
 
 template <typename T>
 T min(const T& A, const T& B) {
@@ -42,6 +55,8 @@ T max(const T& A, const T& B) {
 double ReturnWallTime(void);
 void Reduce_Times(double time, double *time_array);
 
+#define MAX_JSON_ENTRY 1024
+
 namespace enzo_timing{
 
   // Section Performance Class
@@ -61,11 +76,15 @@ namespace enzo_timing{
       total_time = 0.0;
       current_time = 0.0;
       ncell_updates = 0;
+      nbytes = 0;
+      ncalls = 0;
+      reset_grid_times();
     }
    
     // Start Timer 
     void start(void){
       t0 = ReturnWallTime();
+      ncalls++;
     }
   
     // Stop Timer, add to current/total times
@@ -89,6 +108,9 @@ namespace enzo_timing{
     void reset_current_time(void){
       current_time = 0.0;
       ncell_updates = 0.0;
+      nbytes = 0.0;
+      ncalls = 0;
+      reset_grid_times();
     }
 
     // Access the ncell_updates counter
@@ -111,20 +133,88 @@ namespace enzo_timing{
       ncell_updates += my_ncell_updates;
     }
 
+    // Access/add the bytes sent since write-out
+    double get_bytes(void){
+      return nbytes;
+    }
+    void add_bytes(double my_nbytes){
+      nbytes += my_nbytes;
+    }
+
+    // Access the number of start() calls since write-out
+    long int get_calls(void){
+      return ncalls;
+    }
+
+    // Add the wall time spent on one grid (for level timers)
+    void add_grid_time(double my_time){
+      grid_time_min = (ngrid_times > 0) ? min(grid_time_min, my_time) : my_time;
+      grid_time_max = (ngrid_times > 0) ? max(grid_time_max, my_time) : my_time;
+      grid_time_sum += my_time;
+      ngrid_times++;
+    }
+
+    // Access the per-grid times since write-out
+    void get_grid_times(double *count, double *sum, double *min_time,
+                        double *max_time){
+      *count = ngrid_times;
+      *sum = grid_time_sum;
+      *min_time = grid_time_min;
+      *max_time = grid_time_max;
+    }
+
+    // Add the time, calls, cells and bytes of another timer, e.g. the
+    // copy of this timer kept by one thread.
+    void merge(section_performance *other){
+      current_time += other->current_time;
+      total_time += other->current_time;
+      ncalls += other->ncalls;
+      ncell_updates += other->ncell_updates;
+      nbytes += other->nbytes;
+    }
+
     std::string name;           // Name of the timer
     section_performance *next;  // Pointer to the next timer 
   
   private:
     double ncell_updates; // Number of cell updates since write-out
+    double nbytes;        // Bytes sent by MPI since write-out
+    long int ncalls;      // Number of times started since write-out
     double t0;            // Start Time
     double t1;            // End Time
     double total_time;    // Total time during the simulation
     double current_time;  // Time spent in this timer since last write-out
     long int ngrids;      // Number of Grids (For Level Timers)
+    long int ngrid_times; // Number of grid times since write-out
+    double grid_time_sum; // Sum, min and max of the grid times
+    double grid_time_min;
+    double grid_time_max;
+
+    void reset_grid_times(void){
+      ngrid_times = 0;
+      grid_time_sum = grid_time_min = grid_time_max = 0.0;
+    }
     
   };
   typedef std::map<std::string, section_performance *> SectionMap;
 
+  // Stack of the open regions, innermost last
+  struct region_stack
+  {
+    std::vector<section_performance *> active;  // Open regions
+    std::vector<std::string> names;             // Their timer names
+    std::vector<bool> timed;                    // Whether they are timed
+  };
+
+  // Timers and regions recorded by one thread inside a threaded loop.
+  // They are added to the shared ones at the next write-out.
+  struct thread_timers
+  {
+    SectionMap timers;
+    SectionMap regions;
+    region_stack stack;
+  };
+
   /* --------------------------------------------------------- */
 
   // enzo_timer class definition
@@ -133,23 +223,34 @@ namespace enzo_timing{
   // timers. 
   class enzo_timer
   {
+  private:
+    thread_timers shared;       // Outside threaded loops
+
   public:
 
     // Constructor, uses default filename.
-    enzo_timer(void){
+    enzo_timer(void) : timers(shared.timers), regions(shared.regions){
       total_time = 0.0;
       current_time = 0.0;
       filename = (char *)("performance.out");
+      json_filename = "performance.json";
       set_mpi_environment();
       first_write = true;
       //last_cycle = 0;
     }
 
     // Constructor, accepts non-standard filename
-    enzo_timer(char *performance_name){
+    enzo_timer(char *performance_name) :
+      timers(shared.timers), regions(shared.regions){
       total_time = 0.0;
       current_time = 0.0;
       filename = performance_name;
+      // The region tree goes next to it, e.g. run.out -> run.json
+      json_filename = performance_name;
+      size_t suffix = json_filename.size() - min(json_filename.size(), (size_t) 4);
+      if (json_filename.compare(suffix, std::string::npos, ".out") == 0)
+        json_filename.erase(suffix);
+      json_filename += ".json";
       set_mpi_environment();
       first_write = true;
       //last_cycle = 0;
@@ -159,9 +260,20 @@ namespace enzo_timing{
     ~enzo_timer(void){
       for( SectionMap::iterator iter=timers.begin(); iter!=timers.end(); ++iter){
         delete iter->second;
-        timers.erase(iter);
       }
       timers.clear();
+      for (SectionMap::iterator iter=regions.begin(); iter!=regions.end(); ++iter)
+        delete iter->second;
+      regions.clear();
+      for (size_t t=0; t<threads.size(); t++){
+        for (SectionMap::iterator iter=threads[t].timers.begin();
+             iter!=threads[t].timers.end(); ++iter)
+          delete iter->second;
+        for (SectionMap::iterator iter=threads[t].regions.begin();
+             iter!=threads[t].regions.end(); ++iter)
+          delete iter->second;
+      }
+      threads.clear();
     }
 
     // Sets up nprocs/my_rank properly.
@@ -177,7 +289,7 @@ namespace enzo_timing{
 
     // Use SectionMap std::map objects to store timers
     // in a linked list.
-    SectionMap timers;
+    SectionMap &timers;
 
     // Accessor for section performance object
     section_performance * get(char *name){
@@ -192,15 +304,85 @@ namespace enzo_timing{
       return;
     }
 
-    // Start a timer by name
+    // Regions, keyed by their path in the tree of nested timers
+    SectionMap &regions;
+
+    // Start a timer by name.  Inside a threaded grid loop each thread
+    // records to its own copies of the timers and regions, which are
+    // added up at the next write-out, so the time reported for a timer
+    // started there is summed over the threads.
     void start(char *name){
-      this->create(name);
-      timers[name]->start();
+      thread_timers *my = this->select();
+      if (my == NULL) return;
+      find_or_create(my->timers, name)->start();
+      this->start_region(name);
     }
 
     // Stop a timer by name
     void stop(char *name){
-      timers[name]->stop();
+      thread_timers *my = this->select();
+      if (my == NULL) return;
+      SectionMap::iterator iter = my->timers.find(name);
+      if (iter != my->timers.end())
+        iter->second->stop();
+      this->stop_region(name);
+    }
+
+    // Enter a region of the tree without a flat timer, e.g. to put
+    // work done outside a level's timer under that level.  An untimed
+    // region only collects the regions started inside it; its own
+    // time and calls are not changed.
+    void start_region(char *name, bool timed = true){
+      thread_timers *my = this->select();
+      if (my == NULL) return;
+      std::string parent = this->innermost_path(my);
+      std::string path = (parent.empty()) ? std::string(name) :
+        parent + "/" + name;
+      region_stack &st = my->stack;
+      st.active.push_back(find_or_create(my->regions, path));
+      st.names.push_back(name);
+      st.timed.push_back(timed);
+      if (timed) st.active.back()->start();
+    }
+
+    // Leave a region.  Regions left open inside it are closed too,
+    // which keeps the tree consistent if a stop was missed.
+    void stop_region(char *name){
+      thread_timers *my = this->select();
+      if (my == NULL) return;
+      region_stack &st = my->stack;
+      int n = st.names.size();
+      while (n > 0 && st.names[n-1] != name) n--;
+      if (n == 0) return;
+      while ((int) st.active.size() >= n){
+        if (st.timed.back()) st.active.back()->stop();
+        st.active.pop_back();
+        st.names.pop_back();
+        st.timed.pop_back();
+      }
+    }
+
+    // Add the size of an MPI message to the innermost region
+    void add_bytes(double nbytes){
+      thread_timers *my = this->select();
+      if (my == NULL) return;
+      std::string path = this->innermost_path(my);
+      if (!path.empty())
+        find_or_create(my->regions, path)->add_bytes(nbytes);
+    }
+
+#ifdef USE_MPI
+    void add_mpi_bytes(int count, MPI_Datatype type){
+      int type_size;
+      MPI_Type_size(type, &type_size);
+      this->add_bytes((double) count * type_size);
+    }
+#endif
+
+    // Add the wall time spent on one grid of a level this cycle
+    void add_grid_time(int level, double time){
+      if (this->select() != &shared) return;
+      get_level(level)->add_grid_time(time);
     }
 
     // Get a level section_performance by level
@@ -302,6 +484,8 @@ namespace enzo_timing{
     // Write out performance measures to a file, optionally specifying
     // verbose to get all timers from all processors.
     void write_out(int step, bool verbose=false){
+      this->merge_threads();
+
       if (my_rank == 0){
         performance_file = fopen(filename,"a");
         if (step == 1){
@@ -332,17 +516,27 @@ namespace enzo_timing{
       
       double total_cells = get_total_cells();
       double cell_rate; 
+
+      // The region tree needs the level cell counts, so it is reduced
+      // before the timers are reset.
+      std::string json_regions = this->reduce_regions();
+      std::string json_sections;
+      char json_entry[MAX_JSON_ENTRY];
+
       // Print out info for each timer.
       for( SectionMap::iterator iter=timers.begin(); iter!=timers.end(); ++iter){
         current_time = iter->second->get_current_time();
         Reduce_Times(current_time, time_array);
+        keyname = iter->first;
+        std::string json_grids;
+        if (strncmp(keyname.c_str(), "Level", 5) == 0)
+          json_grids = this->reduce_grid_times(iter->second);
         cell_rate = 0.0;
         if (my_rank == 0){
           this->analyze_times(time_array, nprocs, &mean_time, &stddev_time, &min_time, &max_time);
 
           fprintf(performance_file, "%s %e %e %e %e",
                   iter->first.c_str(), mean_time, stddev_time, min_time, max_time);
-          keyname = iter->first;
           if (strncmp(keyname.c_str(), "Total", 5) == 0){
             total_time = mean_time;
             if (total_time > 0.0)
@@ -352,6 +546,13 @@ namespace enzo_timing{
                     total_cells,
                     get_total_grids(),
                     cell_rate); 
+            snprintf(json_entry, MAX_JSON_ENTRY, "%s\"%s\": {\"mean\": %e, "
+                     "\"stddev\": %e, \"min\": %e, \"max\": %e, "
+                     "\"cell_updates\": %e, \"grids\": %ld, "
+                     "\"cell_updates_per_sec\": %e}",
+                     (json_sections.empty()) ? "" : ", ", keyname.c_str(),
+                     mean_time, stddev_time, min_time, max_time,
+                     total_cells, get_total_grids(), cell_rate);
           }
           if (strncmp(keyname.c_str(), "Level", 5) == 0){
             if (mean_time > 0.0)
@@ -361,7 +562,22 @@ namespace enzo_timing{
                     iter->second->get_cells(),
                     iter->second->get_grids(),
                     cell_rate);
+            snprintf(json_entry, MAX_JSON_ENTRY, "%s\"%s\": {\"mean\": %e, "
+                     "\"stddev\": %e, \"min\": %e, \"max\": %e, "
+                     "\"cell_updates\": %e, \"grids\": %ld, "
+                     "\"cell_updates_per_sec\": %e%s}",
+                     (json_sections.empty()) ? "" : ", ", keyname.c_str(),
+                     mean_time, stddev_time, min_time, max_time,
+                     iter->second->get_cells(), iter->second->get_grids(),
+                     cell_rate, json_grids.c_str());
           }
+          if (strncmp(keyname.c_str(), "Total", 5) != 0 &&
+              strncmp(keyname.c_str(), "Level", 5) != 0)
+            snprintf(json_entry, MAX_JSON_ENTRY, "%s\"%s\": {\"mean\": %e, "
+                     "\"stddev\": %e, \"min\": %e, \"max\": %e}",
+                     (json_sections.empty()) ? "" : ", ", keyname.c_str(),
+                     mean_time, stddev_time, min_time, max_time);
+          json_sections += json_entry;
           if(verbose){
             for (int i=0; i<nprocs; i++){
               fprintf(performance_file, " %e", time_array[i]);
@@ -376,10 +592,247 @@ namespace enzo_timing{
         fprintf(performance_file, "\n");
         fclose(performance_file);      
         delete [] time_array;
+
+        FILE *json_file = fopen(json_filename.c_str(), "a");
+        fprintf(json_file, "{\"cycle\": %d, \"nprocs\": %d, \"sections\": {%s}, "
+                "\"regions\": {%s}}\n", step, nprocs, json_sections.c_str(),
+                json_regions.c_str());
+        fclose(json_file);
       }
     }
           
+    // Reduce the per-grid times of a level over the processes and
+    // return them as JSON on the root: the number of grid updates and
+    // the mean/min/max wall time spent on one grid.
+    std::string reduce_grid_times(section_performance *level){
+      double local[4], global[4];
+      level->get_grid_times(&local[0], &local[1], &local[2], &local[3]);
+      if (local[0] == 0)
+        local[2] = HUGE_VAL;
+#ifdef USE_MPI
+      MPI_Reduce(local, global, 2, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD);
+      MPI_Reduce(local+2, global+2, 1, MPI_DOUBLE, MPI_MIN, 0, MPI_COMM_WORLD);
+      MPI_Reduce(local+3, global+3, 1, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD);
+#else
+      for (int i=0; i<4; i++)
+        global[i] = local[i];
+#endif
+      if (my_rank != 0 || global[0] == 0)
+        return std::string();
+      char entry[MAX_JSON_ENTRY];
+      snprintf(entry, MAX_JSON_ENTRY, ", \"grid_time\": {\"grids\": %.0f, "
+               "\"mean\": %e, \"min\": %e, \"max\": %e}", global[0],
+               global[1]/global[0], global[2], global[3]);
+      return std::string(entry);
+    }
+
+    // Reduce the region tree of this cycle over the processes and
+    // return it as JSON on the root.  Each region has its calls, the
+    // mean/stddev/min/max time, the imbalance (max/mean), the bytes
+    // sent and, inside a level, the cell updates of that level.
+    std::string reduce_regions(void){
+      std::vector<std::string> paths;
+      this->collect_region_paths(paths);
+
+      const int nval = 3;   // time, calls, bytes
+      int npaths = paths.size();
+      double *values = new double[nval*npaths+1];
+      double *all_values = NULL;
+      for (int i=0; i<npaths; i++){
+        SectionMap::iterator iter = regions.find(paths[i]);
+        section_performance *region = (iter == regions.end()) ? NULL : iter->second;
+        values[nval*i  ] = (region) ? region->get_current_time() : 0.0;
+        values[nval*i+1] = (region) ? region->get_calls() : 0.0;
+        values[nval*i+2] = (region) ? region->get_bytes() : 0.0;
+      }
+
+#ifdef USE_MPI
+      if (my_rank == 0)
+        all_values = new double[nprocs*nval*npaths+1];
+      MPI_Gather(values, nval*npaths, MPI_DOUBLE, all_values, nval*npaths,
+                 MPI_DOUBLE, 0, MPI_COMM_WORLD);
+#else
+      all_values = values;
+#endif
+
+      std::string json;
+      if (my_rank == 0){
+        char entry[MAX_JSON_ENTRY];
+        double *time_array = new double[nprocs];
+        double mean_time, stddev_time, min_time, max_time;
+        double calls, bytes, max_bytes, cells;
+        for (int i=0; i<npaths; i++){
+          calls = bytes = max_bytes = 0.0;
+          for (int p=0; p<nprocs; p++){
+            double *v = all_values + (p*npaths + i)*nval;
+            time_array[p] = v[0];
+            calls = max(calls, v[1]);
+            bytes += v[2];
+            max_bytes = max(max_bytes, v[2]);
+          }
+          this->analyze_times(time_array, nprocs, &mean_time, &stddev_time,
+                              &min_time, &max_time);
+          snprintf(entry, MAX_JSON_ENTRY, "%s\"%s\": {\"depth\": %d, "
+                   "\"calls\": %.0f, \"mean\": %e, \"stddev\": %e, "
+                   "\"min\": %e, \"max\": %e, \"imbalance\": %e, "
+                   "\"bytes\": %.0f, \"max_bytes\": %.0f",
+                   (i > 0) ? ", " : "", paths[i].c_str(), region_depth(paths[i]),
+                   calls, mean_time, stddev_time, min_time, max_time,
+                   (mean_time > 0.0) ? max_time/mean_time : 0.0, bytes, max_bytes);
+          json += entry;
+          if (region_level_cells(paths[i], &cells)){
+            snprintf(entry, MAX_JSON_ENTRY, ", \"cell_updates\": %e, "
+                     "\"cell_updates_per_sec\": %e", cells,
+                     (mean_time > 0.0) ? cells/mean_time/nprocs : 0.0);
+            json += entry;
+          }
+          json += "}";
+        }
+        delete [] time_array;
+      }
+
+      for (SectionMap::iterator iter=regions.begin(); iter!=regions.end(); ++iter)
+        iter->second->reset_current_time();
+      if (all_values != values)
+        delete [] all_values;
+      delete [] values;
+
+      return json;
+    }
+
   private:
+    std::vector<thread_timers> threads;  // One per OpenMP thread
+    std::string json_filename;  // File for the region tree
+
+    static section_performance * find_or_create(SectionMap &map,
+                                                const std::string &name){
+      SectionMap::iterator iter = map.find(name);
+      if (iter != map.end())
+        return iter->second;
+      return map[name] = new section_performance((char *) name.c_str());
+    }
+
+    // The timers to record to: the shared ones, or the calling
+    // thread's inside a parallel region.  Outside parallel regions
+    // there is one set per thread allowed, as the number of threads
+    // is only known once the parameters have been read.
+    thread_timers * select(void){
+#ifdef USE_OPENMP
+      if (omp_in_parallel()){
+        int thread = omp_get_thread_num();
+        return (thread < (int) threads.size()) ? &threads[thread] : NULL;
+      }
+      if ((int) threads.size() < omp_get_max_threads())
+        threads.resize(omp_get_max_threads());
+#endif
+      return &shared;
+    }
+
+    // Path of the innermost open region.  A thread's regions hang
+    // under the shared region that was open when the loop started.
+    std::string innermost_path(thread_timers *my){
+      if (!my->stack.active.empty())
+        return my->stack.active.back()->name;
+      if (!shared.stack.active.empty())
+        return shared.stack.active.back()->name;
+      return std::string();
+    }
+
+    // Add the timers and regions recorded by the threads to the
+    // shared ones.
+    void merge_threads(void){
+      for (size_t t=0; t<threads.size(); t++){
+        for (SectionMap::iterator iter=threads[t].timers.begin();
+             iter!=threads[t].timers.end(); ++iter){
+          find_or_create(timers, iter->first)->merge(iter->second);
+          delete iter->second;
+        }
+        for (SectionMap::iterator iter=threads[t].regions.begin();
+             iter!=threads[t].regions.end(); ++iter){
+          find_or_create(regions, iter->first)->merge(iter->second);
+          delete iter->second;
+        }
+        threads[t].timers.clear();
+        threads[t].regions.clear();
+        threads[t].stack = region_stack();
+      }
+    }
+
+    // Regions only entered on some processes still have to be reduced
+    // everywhere, so every process gets the union of the paths.
+    void collect_region_paths(std::vector<std::string> &paths){
+      std::string local;
+      for (SectionMap::iterator iter=regions.begin(); iter!=regions.end(); ++iter)
+        local += iter->first + "\n";
+#ifdef USE_MPI
+      int length = local.size(), total = 0;
+      int *lengths = NULL, *displs = NULL;
+      char *buffer = NULL;
+      if (my_rank == 0){
+        lengths = new int[nprocs];
+        displs = new int[nprocs];
+      }
+      MPI_Gather(&length, 1, MPI_INT, lengths, 1, MPI_INT, 0, MPI_COMM_WORLD);
+      if (my_rank == 0){
+        for (int p=0; p<nprocs; p++){
+          displs[p] = total;
+          total += lengths[p];
+        }
+        buffer = new char[total+1];
+      }
+      MPI_Gatherv((void *) local.c_str(), length, MPI_CHAR, buffer, lengths,
+                  displs, MPI_CHAR, 0, MPI_COMM_WORLD);
+      if (my_rank == 0){
+        std::set<std::string> names;
+        size_t first = 0, last;
+        std::string all(buffer, total);
+        while ((last = all.find('\n', first)) != std::string::npos){
+          names.insert(all.substr(first, last-first));
+          first = last+1;
+        }
+        local.clear();
+        for (std::set<std::string>::iterator it=names.begin(); it!=names.end(); ++it)
+          local += *it + "\n";
+        length = local.size();
+        delete [] buffer;
+        delete [] lengths;
+        delete [] displs;
+      }
+      MPI_Bcast(&length, 1, MPI_INT, 0, MPI_COMM_WORLD);
+      buffer = new char[length+1];
+      if (my_rank == 0)
+        memcpy(buffer, local.c_str(), length);
+      MPI_Bcast(buffer, length, MPI_CHAR, 0, MPI_COMM_WORLD);
+      local.assign(buffer, length);
+      delete [] buffer;
+#endif
+      size_t first = 0, last;
+      while ((last = local.find('\n', first)) != std::string::npos){
+        paths.push_back(local.substr(first, last-first));
+        first = last+1;
+      }
+    }
+
+    static int region_depth(const std::string &path){
+      int depth = 0;
+      for (size_t i=0; i<path.size(); i++)
+        if (path[i] == '/') depth++;
+      return depth;
+    }
+
+    // Cell updates of the innermost level that contains the region
+    bool region_level_cells(const std::string &path, double *cells){
+      size_t pos = path.rfind("Level_");
+      if (pos == std::string::npos)
+        return false;
+      std::string name = path.substr(pos, path.find('/', pos) - pos);
+      SectionMap::iterator iter = timers.find(name);
+      if (iter == timers.end())
+        return false;
+      *cells = iter->second->get_cells();
+      return true;
+    }
+
     FILE * performance_file;    // File to write stats to
     double total_time;      // Total time
     double current_time;    // Current Time since last write_out
@@ -408,6 +861,10 @@ EXTERN enzo_timing::enzo_timer *enzo_timer;   // Add global timer
 #define TIMER_REGISTER(name) enzo_timer->create(name)
 #define TIMER_ADD_CELLS(level, cells) enzo_timer->get_level(level)->add_cells(cells)
 #define TIMER_SET_NGRIDS(level, grids) enzo_timer->get_level(level)->set_ngrids(grids)
+#define TIMER_ADD_GRID_TIME(level, time) enzo_timer->add_grid_time(level, time)
+#define TIMER_REGION_START(name) enzo_timer->start_region(name, false)
+#define TIMER_REGION_STOP(name) enzo_timer->stop_region(name)
+#define TIMER_ADD_MPI_BYTES(count, type) do { if (enzo_timer) enzo_timer->add_mpi_bytes(count, type); } while (0)
 #else
 #define TIMER_START(section_name)
 #define TIMER_STOP(section_name)
@@ -415,6 +872,10 @@ EXTERN enzo_timing::enzo_timer *enzo_timer;   // Add global timer
 #define TIMER_REGISTER(name)
 #define TIMER_ADD_CELLS(level, cells)
 #define TIMER_SET_NGRIDS(level, grids)
+#define TIMER_ADD_GRID_TIME(level, time)
+#define TIMER_REGION_START(name)
+#define TIMER_REGION_STOP(name)
+#define TIMER_ADD_MPI_BYTES(count, type)
 #endif
 
 #endif //ENZO_TIMING
@@ -213,6 +213,8 @@ class grid
 //  Parallel Information
 //
   int ProcessorNumber;
+  float ComputeCost;                // measured wall time per cycle (smoothed)
+  float CycleComputeCost;           // wall time measured so far this cycle
 //
 // Movie Data Format
 //
@@ -862,6 +864,19 @@ gradient force to gravitational force for one-zone collapse test. */
 
    void DeleteBaryonFields();
 
+/* RebuildHierarchy (RebuildHierarchyReuseGrids): use the baryon fields of
+   an old grid covering the same cells, and drop them from the old grid
+   without deleting them. */
+
+   void ShareBaryonFields(grid *OldGrid) {
+     for (int field = 0; field < NumberOfBaryonFields; field++)
+       BaryonField[field] = OldGrid->BaryonField[field];
+   };
+   void ForgetBaryonFields() {
+     for (int field = 0; field < MAX_NUMBER_OF_BARYON_FIELDS; field++)
+       BaryonField[field] = NULL;
+   };
+
 /* Sum particle mass flagging fields into ProcessorNumber if particles
    aren't local. */
 #ifdef INDIVIDUALSTAR // NEED TO DO THINS LIKE REBUILD HIERARCHY FUNCTIONS
@@ -1108,6 +1123,17 @@ gradient force to gravitational force for one-zone collapse test. */
   int CopyActiveZonesFromGrid(grid *GridOnSameLevel,
                   FLOAT EdgeOffset[MAX_DIMENSION], int SendField);
 
+/* baryons: the aggregated sibling exchange (CommunicationSiblingExchange).
+            RecordSiblingOverlap adds the region CopyZonesFromGrid would
+            copy to the exchange plan; the others pack/unpack/copy it. */
+
+   int RecordSiblingOverlap(grid *GridOnSameLevel,
+			    FLOAT EdgeOffset[MAX_DIMENSION]);
+   int PackSiblingRegion(float *buffer, int RegionStart[], int RegionDim[]);
+   int UnpackSiblingRegion(float *buffer, int RegionStart[], int RegionDim[]);
+   int CopySiblingRegion(grid *GridOnSameLevel, int Start[], int StartOther[],
+			 int RegionDim[]);
+
 /* gravity: copy coincident potential field zones from grid in the argument
             (gg #7).  Return SUCCESS or FAIL. */
 
@@ -1138,6 +1164,19 @@ gradient force to gravitational force for one-zone collapse test. */
                           boundary_type LeftBoundaryCondition[],
                           boundary_type RightBoundaryCondition[]);
 
+/* The region searched for siblings (that of the gravitating mass field),
+   used by the hierarchy directory. */
+
+   void ReturnSiblingSearchRegion(FLOAT Left[], FLOAT Right[]) {
+     if (GravitatingMassFieldCellSize == FLOAT_UNDEFINED)
+       this->InitializeGravitatingMassField(RefineBy);
+     for (int dim = 0; dim < MAX_DIMENSION; dim++) {
+       Left[dim] = GravitatingMassFieldLeftEdge[dim];
+       Right[dim] = GravitatingMassFieldLeftEdge[dim] +
+	 GravitatingMassFieldCellSize * GravitatingMassFieldDimension[dim];
+     }
+   };
+
    /* hack: add density squared field to grid (used in ExtractSection). */
 
    void CreateDensitySquaredField() {
@@ -1224,7 +1263,8 @@ gradient force to gravitational force for one-zone collapse test. */
 
 /* Gravity: Allocate and make initial guess for PotentialField. */
 
-   int SolveForPotential(int level, FLOAT PotentialTime = -1);
+   int SolveForPotential(int level, FLOAT PotentialTime = -1,
+			 int *Iterations = NULL);
 
 /* Gravity: Prepare the Greens Function. */
 
@@ -1788,11 +1828,13 @@ iveParticles;};
    int AddOneParticleFromList(ParticleEntry *List, const int place);
    int CheckGridBoundaries(FLOAT *Position);
 
-/* Particles: sort particle data in ascending order by number (id) or type. */
+/* Particles: sort particle data in ascending order by number (id), type
+   or cell. */
 
 void SortParticlesByNumber();
 void SortActiveParticlesByNumber();
 void SortParticlesByType();
+void SortParticlesByCell();
 
 int CreateParticleTypeGrouping(hid_t ptype_dset,
                                hid_t ptype_dspace,
@@ -1818,6 +1860,26 @@ int CreateParticleTypeGrouping(hid_t ptype_dset,
     return ProcessorNumber;
   }
 
+/* Measured compute cost, used by the load balancers with
+   LoadBalancingMeasuredCost.  AddComputeCost accumulates the wall time
+   spent on this grid and UpdateComputeCost folds it into the smoothed
+   cost at the end of each cycle. */
+
+  float ReturnComputeCost() { return ComputeCost; };
+  float ReturnCycleComputeCost() { return CycleComputeCost; };
+  void SetComputeCost(float cost) {
+    ComputeCost = cost;
+    CycleComputeCost = 0;
+  };
+  void AddComputeCost(float dt) { CycleComputeCost += dt; };
+  void UpdateComputeCost() {
+    if (MyProcessorNumber == ProcessorNumber)
+      ComputeCost = (ComputeCost > 0) ?
+	LoadBalancingCostSmoothing * CycleComputeCost +
+	(1-LoadBalancingCostSmoothing) * ComputeCost : CycleComputeCost;
+    CycleComputeCost = 0;
+  };
+
 /* Send a region from a real grid to a 'fake' grid on another processor. */
 
   int CommunicationSendRegion(grid *ToGrid, int ToProcessor, int SendField,
@@ -1830,11 +1892,13 @@ int CreateParticleTypeGrouping(hid_t ptype_dset,
 				 int RegionStart[], int RegionDim[],
 				 int IncludeBoundary);
 
-/* Move a grid from one processor to another. */
+/* Move a grid from one processor to another (MoveBaryonFields = FALSE
+   for a new grid whose fields are not allocated yet). */
 
   int CommunicationMoveGrid(int ToProcessor, int MoveParticles = TRUE,
 			    int DeleteAllFields = TRUE,
-			    int MoveSubgridMarker = FALSE);
+			    int MoveSubgridMarker = FALSE,
+			    int MoveBaryonFields = TRUE);
 
 /* Send particles from one grid to another. */
 
@@ -2042,6 +2106,11 @@ int zEulerSweep(int j, int NumberOfSubgrids, fluxes *SubgridFluxes[],
 		Elong_int GridGlobalStart[], float *CellWidthTemp[],
 		int GravityOn, int NumberOfColours, int colnum[], float *pressure);
 
+int PencilEulerSweep(int dim, int NumberOfSubgrids, fluxes *SubgridFluxes[],
+		     Elong_int GridGlobalStart[], float *CellWidthTemp[],
+		     int GravityOn, int NumberOfColours, int colnum[],
+		     float *pressure);
+
 // AccelerationHack
 
   int AccelerationHack;
@@ -53,6 +53,10 @@ void DeleteSubgridMarker() { delete [] SubgridMarker; SubgridMarker = NULL; };
 
    int PhotonSortLinkedLists(void);
 
+/* gather, sort and relink photon packages in memory order */
+
+   int CompactPhotonPackages(int MinimumNumberOfPackages);
+
 /* Set Subgrid Marker field */
 
    int SetSubgridMarkerFromSubgrid(grid *Subgrid);
@@ -0,0 +1,73 @@
+/***********************************************************************
+/
+/  PHOTON PACKAGE ARRAY CLASS
+/
+/  PURPOSE: Structure-of-arrays copy of a linked list of photon
+/           packages.  Each quantity in PhotonPackageEntry is stored
+/           in its own contiguous array so that the list can be
+/           compacted and sorted without chasing NextPackage pointers,
+/           and then written back into the original list nodes in
+/           memory order.
+/
+************************************************************************/
+#ifndef __PHOTONPACKAGEARRAY_H
+#define __PHOTONPACKAGEARRAY_H
+#include "PhotonPackage.h"
+
+class PhotonPackageArray
+{
+public:
+  int NumberOfPackages;          // number of packages stored
+  int Size;                      // allocated length of the arrays
+
+  PhotonPackageEntry **Node;     // list node each package was gathered from
+  SuperSourceEntry **CurrentSource;
+  float  *Photons;
+  int    *Type;
+  float  *Energy;
+  double *CrossSection;
+  FLOAT  *EmissionTimeInterval;
+  FLOAT  *EmissionTime;
+  FLOAT  *CurrentTime;
+  FLOAT  *Radius;
+  float  *ColumnDensity;
+  long   *level;
+  int64_t *ipix;
+  FLOAT  *SourcePosition[3];
+  float  *SourcePositionDiff;
+
+  /* CONSTRUCTOR AND DESTRUCTOR */
+
+  PhotonPackageArray(void);
+  ~PhotonPackageArray(void);
+
+  /* Allocate (or grow) the arrays to hold n packages */
+
+  void Allocate(int n);
+  void DeleteArrays(void);
+
+  /* Copy the list starting after the head node into the arrays.
+     Returns the number of packages gathered. */
+
+  int Gather(PhotonPackageEntry *Head);
+
+  /* Remove packages without any photons, deleting their list nodes.
+     Returns the number of packages removed. */
+
+  int Compact(void);
+
+  /* Sort the packages by source, HEALPix level, pixel and type so
+     that neighbouring rays are adjacent. */
+
+  void SortByPixel(void);
+
+  /* Write the packages back into the gathered list nodes, with the
+     nodes relinked after the head node in increasing address order. */
+
+  void Scatter(PhotonPackageEntry *Head);
+
+private:
+  void Permute(const int *order);
+};
+
+#endif /* PHOTONPACKAGEARRAY_H */
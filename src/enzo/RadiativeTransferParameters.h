@@ -121,6 +121,11 @@ EXTERN char *RadiativeTransferTraceSpectrumTable;
 
 EXTERN int RadiativeTransferLoadBalance;
 
+/* Compact and sort the photon packages of grids with at least this
+   many packages before transporting them (0 = off) */
+
+EXTERN int RadiativeTransferCompactPhotons;
+
 /* Flux threshold when rays are deleted in units of the UV background
    flux (RadiationFieldType > 0) */
 
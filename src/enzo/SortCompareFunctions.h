@@ -49,6 +49,49 @@ struct cmp_proc1 {
   }
 };
 
+// key functions for BucketSort (particle_data, star_data, two_int)
+
+struct key_grid {
+  template <class T> int operator()(T const& a) const { return a.grid; }
+};
+
+struct key_proc {
+  template <class T> int operator()(T const& a) const { return a.proc; }
+};
+
+// Stable sort of a move list by a small integer key (grid or processor
+// number) in time linear in the length of the list and the key range.
+
+template <class T, class Key>
+void BucketSort(T *List, int n, Key key)
+{
+  if (n < 2)
+    return;
+  int i, k, KeyMin = key(List[0]), KeyMax = key(List[0]);
+  for (i = 1; i < n; i++) {
+    k = key(List[i]);
+    if (k < KeyMin) KeyMin = k;
+    if (k > KeyMax) KeyMax = k;
+  }
+  if (KeyMin == KeyMax)
+    return;
+  int NumberOfKeys = KeyMax - KeyMin + 1;
+  int *Start = new int[NumberOfKeys+1];
+  for (k = 0; k <= NumberOfKeys; k++)
+    Start[k] = 0;
+  for (i = 0; i < n; i++)
+    Start[key(List[i])-KeyMin+1]++;
+  for (k = 0; k < NumberOfKeys; k++)
+    Start[k+1] += Start[k];
+  T *Sorted = new T[n];
+  for (i = 0; i < n; i++)
+    Sorted[Start[key(List[i])-KeyMin]++] = List[i];
+  for (i = 0; i < n; i++)
+    List[i] = Sorted[i];
+  delete [] Sorted;
+  delete [] Start;
+}
+
 #ifdef TRANSFER
 #include "PhotonPackage.h"
 struct cmp_ss {
@@ -20,6 +20,19 @@
 #include "LevelHierarchy.h"
 #include "StarBuffer.h"
 
+class Star;
+
+/* A block of stars allocated together for the global star list.  The
+   stars are linked in index order, so traversing the list walks memory
+   sequentially, and a star's index in the block is stable until the
+   block is released with its last star (see StarListRoutines.C). */
+
+struct StarArray {
+  Star	*Stars;
+  int	 NumberOfStars;
+  int	 NumberAlive;
+};
+
 class Star
 {
 
@@ -62,6 +75,7 @@ class Star
   double wind_mass_ejected;
   double sn_mass_ejected;
 
+  StarArray	*Array;		// NULL unless allocated in a StarArray
 
   friend class grid;
 
@@ -81,7 +95,7 @@ public:
   void operator=(Star a);
   Star operator+(Star a);
   Star operator+=(Star a);
-  Star* copy(void);
+  Star* copy(Star *a = NULL);
 
   // Routines
   star_type ReturnType(void) { return type; };
@@ -141,6 +155,9 @@ public:
   int   ReturnFeedbackFlag(void) { return FeedbackFlag; };
   grid *ReturnCurrentGrid(void) { return CurrentGrid; };
   void  AssignCurrentGrid(grid *a) { this->CurrentGrid = a; };
+  StarArray *ReturnArray(void) { return Array; };
+  void  AssignArray(StarArray *a) { this->Array = a; };
+  int   ReturnArrayIndex(void) { return (Array) ? this - Array->Stars : -1; };
   bool  MarkedToDelete(void) { return type == TO_DELETE; };
   void  MarkForDeletion(void) { type = TO_DELETE; };
   void  AddMass(double dM) { Mass += dM; };
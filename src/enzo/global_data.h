@@ -47,6 +47,14 @@ EXTERN int CoresPerNode;
 EXTERN int PreviousMaxTask;
 EXTERN int LoadBalancingMinLevel;
 EXTERN int LoadBalancingMaxLevel;
+EXTERN int LoadBalancingMeasuredCost;
+EXTERN float LoadBalancingCostSmoothing;
+EXTERN int SiblingExchangeAggregation;
+
+/* Find the sibling grids through a directory distributed by Hilbert key
+   instead of searching every grid of the level on each processor. */
+
+EXTERN int UseHierarchyDirectory;
 
 /* FileDirectedOutput checks for file existence:
    stopNow (writes, stops),   outputNow, subgridcycleCount */
@@ -218,6 +226,11 @@ EXTERN float MinimumEfficiency;
 EXTERN int SubgridSizeAutoAdjust;
 EXTERN int OptimalSubgridsPerProcessor;
 
+/* Keep the data of subgrids that cover the same cells after a rebuild
+   instead of interpolating and copying it again. */
+
+EXTERN int RebuildHierarchyReuseGrids;
+
 /* This is the minimum allowable edge size for a new subgrid (>=4) */
 
 EXTERN int MinimumSubgridEdge;
@@ -322,6 +335,12 @@ EXTERN int CopyGravPotential;
 
 EXTERN int PotentialIterations;
 
+/* Stop the potential iterations once the level has converged, and the
+   over-relaxation factor of the multigrid smoother (1 is Gauss-Seidel). */
+
+EXTERN int PotentialIterationsConvergence;
+EXTERN float MultigridRelaxationFactor;
+
 /* Flag indicating whether or not to use the baryon self-gravity approximation
    (subgrid cells influence are approximated by their projection to the
    current grid). */
@@ -368,6 +387,11 @@ EXTERN float DualEnergyFormalismEta2;
 
 EXTERN float ParticleCourantSafetyNumber;
 
+/* Sort the particles of each grid by cell before they are deposited
+   (see grid::SortParticlesByCell). */
+
+EXTERN int ParticleCellOrdering;
+
 /* This is a parameter to control root grid time steps, and is basically
    a hack to ensure that star particles don't get ejected out of grids. */
 
@@ -427,6 +451,7 @@ EXTERN float SGScoeffSSemf;
 /* Multi-species rate equation flag and associated data. */
 
 EXTERN int MultiSpecies;
+EXTERN int MultiSpeciesBatchSize;
 EXTERN int NoMultiSpeciesButColors;
 EXTERN int ThreeBodyRate;
 EXTERN RateDataType RateData;
@@ -585,6 +610,20 @@ EXTERN int StaticPartitionNestedGrids;
 EXTERN int ExtractFieldsOnly;
 EXTERN int First_Pass;
 EXTERN int UnigridTranspose;
+
+/* Root-grid FFT: 0 - Fortran (FFT_METHOD_FORTRAN), 1 - FFTW with
+   estimated plans or wisdom, 2 - FFTW with measured plans. */
+
+EXTERN int FFTMethod;
+
+/* Decomposition of the root-grid FFT: 0 - slabs, 1 - pencils (3D). */
+
+EXTERN int ParallelFFTDecomposition;
+
+/* File the transformed isolated Greens function is saved to and read
+   from on restart (NULL: always compute it). */
+
+EXTERN char *IsolatedGreensFunctionFile;
 EXTERN int NumberOfRootGridTilesPerDimensionPerProcessor;
 EXTERN int CosmologySimulationNumberOfInitialGrids;
 EXTERN int UserDefinedRootGridLayout[3];
@@ -770,6 +809,25 @@ EXTERN FLOAT TracerParticleCreationRightEdge[MAX_DIMENSION];
 EXTERN int   ParticleTypeInFile;
 EXTERN int   OutputParticleTypeGrouping;
 
+/* HDF5 grid output: 0 = contiguous datasets, 1 = chunked + deflate,
+   2 = chunked + shuffle + deflate.  OutputCompressionLevel is the
+   deflate level (1-9). */
+
+EXTERN int   OutputCompression;
+EXTERN int   OutputCompressionLevel;
+
+/* Write the per-task grid files from a background thread.  Files
+   larger than OutputAsynchronousBufferSize (MB) are written
+   synchronously. */
+
+EXTERN int   OutputAsynchronous;
+EXTERN float OutputAsynchronousBufferSize;
+
+/* Number of grid (.cpu) files shared by blocks of tasks; 0 writes one
+   file per task. */
+
+EXTERN int   OutputSharedFiles;
+
 EXTERN int   ExternalBoundaryIO;
 EXTERN int   ExternalBoundaryTypeIO;
 EXTERN int   ExternalBoundaryValueIO;
@@ -873,6 +931,7 @@ EXTERN int NEQ_MHD;
 EXTERN int ReconstructionMethod;
 EXTERN int PositiveReconstruction;
 EXTERN int RiemannSolverFallback;
+EXTERN int PPMPencilBatchSize;
 EXTERN int RiemannSolver;
 EXTERN int ConservativeReconstruction;
 EXTERN int EOSType;
@@ -942,6 +1001,11 @@ EXTERN float DrivingEfficiency;
 /* Parameters to use CUDA extensions */
 EXTERN int UseCUDA;
 
+/* Parameters for OpenMP threading of the local grid loops in EvolveLevel.
+   NumberOfOpenMPThreads <= 0 uses the OMP_NUM_THREADS default. */
+EXTERN int UseOpenMP;
+EXTERN int NumberOfOpenMPThreads;
+
 /* End of Stanford block */
 
 
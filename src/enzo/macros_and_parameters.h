@@ -400,6 +400,10 @@ typedef long long int   HDF5_hid_t;
 #define REAL_TO_COMPLEX    0
 #define COMPLEX_TO_COMPLEX 1
 
+#define FFT_METHOD_FORTRAN       0
+#define FFT_METHOD_FFTW          1
+#define FFT_METHOD_FFTW_MEASURE  2
+
 /* Definitions for grid::RestoreEnergyConsistency */
 
 #define ENTIRE_REGION  0
@@ -487,6 +491,8 @@ typedef long long int   HDF5_hid_t;
 #define MPI_SENDPART_TAG 23
 #define MPI_SENDMARKER_TAG 24
 #define MPI_SGMARKER_TAG 25
+#define MPI_SIBLINGEXCHANGE_TAG 26
+#define MPI_SHAREDOUTPUT_TAG 27
 
 /* The Active Particle tag is this big to ensure that the sends and
    recvs in grid::CommunicationSendActiveParticles match up and that the AP
@@ -47,6 +47,11 @@ struct parmstruct {
   int InitializeGrids;
   int RandomNumberGenerator;
 
+  /* Write the particles also in the ParallelParticleIO files of an enzo
+     run on this many tasks (0 = no). */
+
+  int ParallelParticleIOTasks;
+
   /* Names. */
 
   char *ParticlePositionName;
@@ -20,3 +20,13 @@
 /* debugging flag */
 
 EXTERN int debug;
+
+/* FFT library: FFT_METHOD_FORTRAN, _FFTW or _FFTW_MEASURE */
+
+EXTERN int FFTMethod;
+
+/* Processor identifier for this thread/processor, and the number of
+   processors (1 unless run with MPI). */
+
+EXTERN int MyProcessorNumber;
+EXTERN int NumberOfProcessors;
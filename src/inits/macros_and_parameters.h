@@ -92,6 +92,7 @@ typedef int            MPI_Arg;
 #ifdef SMALL_INTS
 #define Eint int
 #define ISYM "d"
+#define IntDataType MPI_INT
 #define HDF5_INT HDF5_I4
 #define HDF5_FILE_INT HDF5_FILE_I4
 #define nint(A) ( (int) ((A) + 0.5*sign(A)) )
@@ -103,6 +104,7 @@ typedef int            MPI_Arg;
 #define Eint long_int
 #define int long_int
 #define ISYM "lld"
+#define IntDataType MPI_LONG_LONG_INT
 #define HDF5_INT HDF5_I8
 #define HDF5_FILE_INT HDF5_FILE_I8
 #define nint(A) ( (long_int) ((A) + 0.5*sign(A)) )
@@ -114,6 +116,7 @@ typedef int            MPI_Arg;
 #define Eflt float
 #define FLOAT float
 #define FSYM "f"
+#define FloatDataType MPI_FLOAT
 #define GSYM "g"
 #define GOUTSYM ".7g"
 #define HDF5_REAL HDF5_R4
@@ -124,6 +127,7 @@ typedef int            MPI_Arg;
 #define Eflt double
 #define FLOAT double
 #define FSYM "lf"
+#define FloatDataType MPI_DOUBLE
 #define GSYM "g"
 #define GOUTSYM ".14g"
 #define HDF5_REAL HDF5_R8
@@ -155,6 +159,10 @@ typedef int            MPI_Arg;
 #define FLOAT_UNDEFINED  -99999.0
 #define INT_UNDEFINED    -99999
 
+/* Parallel (MPI) inits */
+
+#define ROOT_PROCESSOR 0
+
 /* Macro definitions (things C should have) */
 
 #define max(A,B) ((A) > (B) ? (A) : (B))
@@ -169,6 +177,10 @@ typedef int            MPI_Arg;
 #define REAL_TO_COMPLEX    0
 #define COMPLEX_TO_COMPLEX 1
 
+#define FFT_METHOD_FORTRAN       0
+#define FFT_METHOD_FFTW          1
+#define FFT_METHOD_FFTW_MEASURE  2
+
 /* RH debug */
 
 #define RH_D TRUE
@@ -25,6 +25,7 @@
 
 ### $ python performance_tools.py performance.out
 
+import json
 import matplotlib as mpl
 mpl.use("Agg")
 import pylab as pl
@@ -185,10 +186,23 @@ class perform:
 
     Since this is a record array, you can use these entries as the indices
     when indexing the array (e.g. data['Total']['Cycle']).
+
+    If the file is "performance.json", "data" is built from its sections,
+    which are the same as the lines of "performance.out", and "regions"
+    holds the tree of nested timers, keyed by the path of the region 
+    (e.g. regions['Total/Level_01/SetBoundaryConditions']).  Besides the
+    entries above, each region has "Calls", "Imbalance" (max/mean time),
+    "Bytes" and "Max Bytes" (sent, summed and largest over processors);
+    regions inside a level also have "Cell Updates" and 
+    "Updates/processor/sec" for that level.
     """
     def __init__(self, filename):
         self.filename = filename
-        self.data = self.build_struct(filename)
+        self.regions = {}
+        if filename.endswith(".json"):
+            self.data, self.regions = self.build_struct_json(filename)
+        else:
+            self.data = self.build_struct(filename)
         self.fields = self.data.keys()
  
     def build_struct(self, filename):
@@ -286,6 +300,76 @@ class perform:
             data[key]["Cycle"] = data["Total"]["Cycle"]
         return data
 
+    def build_struct_json(self, filename):
+        """
+        Build the same dictionary of recarrays as build_struct from the 
+        JSON file written by enzo (one line per cycle), and a second 
+        dictionary with the region tree.
+
+        Parameters
+        ----------
+        filename : string
+            The name of the file used as input
+
+        Returns
+        -------
+        out : tuple of two dictionaries
+            The sections, keyed like build_struct, and the regions, keyed
+            by their path.
+        """
+        cycles = []
+        input = open(filename, "r")
+        for line in input:
+            if line.strip():
+                cycles.append(json.loads(line))
+        input.close()
+        num_cycles = len(cycles)
+
+        section_records = [('Cycle', 'float'), ('Mean Time', 'float'),
+                           ('Stddev Time', 'float'), ('Min Time', 'float'),
+                           ('Max Time', 'float')]
+        level_records = section_records + \
+            [('Cell Updates', 'float'), ('Num Grids', 'float'),
+             ('Updates/processor/sec', 'float')]
+        region_records = section_records + \
+            [('Calls', 'float'), ('Imbalance', 'float'), ('Bytes', 'float'),
+             ('Max Bytes', 'float'), ('Cell Updates', 'float'),
+             ('Updates/processor/sec', 'float')]
+        section_names = [('mean', 'Mean Time'), ('stddev', 'Stddev Time'),
+                         ('min', 'Min Time'), ('max', 'Max Time'),
+                         ('cell_updates', 'Cell Updates'),
+                         ('grids', 'Num Grids'), 
+                         ('cell_updates_per_sec', 'Updates/processor/sec'),
+                         ('calls', 'Calls'), ('imbalance', 'Imbalance'),
+                         ('bytes', 'Bytes'), ('max_bytes', 'Max Bytes')]
+
+        ### Sections and regions may not appear in every cycle; they
+        ### are zero in the cycles they are missing from.
+        data = {}
+        regions = {}
+        for i, cycle in enumerate(cycles):
+            for label, out, records in \
+                    [('sections', data, None), ('regions', regions, region_records)]:
+                for name, values in cycle[label].items():
+                    if label == 'sections':
+                        key = " ".join(name.split('_'))
+                        records = level_records if (key == "Total" or \
+                            key.startswith('Level')) else section_records
+                    else:
+                        key = name
+                    if key not in out:
+                        out[key] = np.zeros(num_cycles, dtype=records)
+                    out[key]['Cycle'][i] = cycle['cycle']
+                    for jname, field in section_names:
+                        if jname in values and field in out[key].dtype.names:
+                            out[key][field][i] = values[jname]
+
+        cycle_numbers = np.array([c['cycle'] for c in cycles], dtype='float')
+        for out in [data, regions]:
+            for key in out:
+                out[key]['Cycle'] = cycle_numbers
+        return data, regions
+
     def plot_quantity(self, field_label, y_field_index, 
                       y_field_axis_label="", x_field_index='Cycle', 
                       x_field_axis_label="Cycle Number",
@@ -1011,7 +1095,7 @@ def to_tuple(a):
 
 if __name__ == "__main__":
     from optparse import OptionParser
-    usage = "usage: %prog <.out file>"
+    usage = "usage: %prog <.out or .json file>"
     parser = OptionParser(usage)
     parser.add_option("-s","--smooth",dest="nsmooth",type='int',
                       default=0,